@@ -5,10 +5,13 @@
 
 #ifndef REALMALLOC
 #include "mymalloc.h"
+#else
+#define free_sized(x, n) free(x)
 #endif
 
 #define NUM_ITERATIONS 60
 #define NUM_RUNS 50
+#define REVERSE_OBJECTS 120 // Most 1-byte objects that fit in the heap, for a long list
 
 //Test Test 1: malloc() and immediately free() a 1-byte object, 60 times
 void test_case_1() {
@@ -234,6 +237,76 @@ void test_case_5() {
     printf("Test 5 Completed: Average time per run (Max Memory Allocation): %.2f microseconds\n", average_time);
 }
 
+// Test Case 6: Allocate 120 1-byte objects, then free() them in reverse order
+void test_case_6() {
+    struct timeval start, end;
+    long total_time = 0;
+    printf("Test 6:\n");
+
+    for (int run = 0; run < NUM_RUNS; run++) {
+        char *ptrs[REVERSE_OBJECTS] = {NULL};
+
+        gettimeofday(&start, NULL);
+
+        // Allocate 120 1-byte objects
+        for (int i = 0; i < REVERSE_OBJECTS; i++) {
+            ptrs[i] = malloc(1);
+            if (ptrs[i] == NULL) {
+                fprintf(stderr, "Test 6 Failed: malloc() returned NULL at iteration %d\n", i);
+                exit(1);
+            }
+        }
+
+        // Free from the back, so free() has to walk most of the list to find each header
+        for (int i = REVERSE_OBJECTS - 1; i >= 0; i--) {
+            free(ptrs[i]);
+        }
+
+        gettimeofday(&end, NULL);
+
+        // Calculate total elapsed time
+        total_time += ((end.tv_sec - start.tv_sec) * 1000000L + end.tv_usec) - start.tv_usec;
+    }
+
+    double average_time = total_time / (double)NUM_RUNS;
+    printf("Test 6 Completed: Average time per run (Reverse Free): %.2f microseconds\n", average_time);
+}
+
+// Test Case 7: Same as Test 6, but deallocating with free_sized()
+void test_case_7() {
+    struct timeval start, end;
+    long total_time = 0;
+    printf("Test 7:\n");
+
+    for (int run = 0; run < NUM_RUNS; run++) {
+        char *ptrs[REVERSE_OBJECTS] = {NULL};
+
+        gettimeofday(&start, NULL);
+
+        // Allocate 120 1-byte objects
+        for (int i = 0; i < REVERSE_OBJECTS; i++) {
+            ptrs[i] = malloc(1);
+            if (ptrs[i] == NULL) {
+                fprintf(stderr, "Test 7 Failed: malloc() returned NULL at iteration %d\n", i);
+                exit(1);
+            }
+        }
+
+        // Free from the back, passing the size so only one list walk is needed
+        for (int i = REVERSE_OBJECTS - 1; i >= 0; i--) {
+            free_sized(ptrs[i], 1);
+        }
+
+        gettimeofday(&end, NULL);
+
+        // Calculate total elapsed time
+        total_time += ((end.tv_sec - start.tv_sec) * 1000000L + end.tv_usec) - start.tv_usec;
+    }
+
+    double average_time = total_time / (double)NUM_RUNS;
+    printf("Test 7 Completed: Average time per run (Reverse Sized Free): %.2f microseconds\n", average_time);
+}
+
 int main() {
     printf("Starting performance tests with custom malloc and free:\n");
 
@@ -242,5 +315,7 @@ int main() {
     test_case_3();
     test_case_4(); //Allocate and deallocate with random sizes
     test_case_5(); //Allocate max memory into heap
+    test_case_6(); //Free in reverse order with free()
+    test_case_7(); //Free in reverse order with free_sized()
     return 0;
 }
@@ -9,6 +9,9 @@
 // Compile with -DREALMALLOC to use the real malloc() instead of mymalloc()
 #ifndef REALMALLOC
 #include "mymalloc.h"
+#else
+#include <malloc.h>
+#define free_sized(x, n) free(x)
 #endif
 
 // Compile with -DLEAK to leak memory
@@ -138,7 +141,7 @@ void test_coalescing() {
 }
 
 void test_leak_detection() {
-    printf("Test 4: Leak Detection\n");
+    printf("Test 5: Leak Detection\n");
 
     char *objs[OBJECTS];
     int i;
@@ -147,20 +150,91 @@ void test_leak_detection() {
     for (i = 0; i < OBJECTS; i++) {
         objs[i] = malloc(OBJSIZE);
         if (objs[i] == NULL) {
-            fprintf(stderr, "Test 4 Failed: Unable to allocate object %d\n", i);
+            fprintf(stderr, "Test 5 Failed: Unable to allocate object %d\n", i);
             exit(1);
         }
     }
 
-    printf("Test 4: Allocated memory without freeing to test leak detection\n");
+    printf("Test 5: Allocated memory without freeing to test leak detection\n");
 
     // Leak detector should report the leaked memory upon program exit
     // No need to free objs[]
 }
 
+void test_sized_free() {
+    printf("Test 4: Sized Free and Usable Size\n");
+
+    char *objs[OBJECTS];
+    int i;
+
+    // Allocate objects with sizes that are not multiples of 8
+    for (i = 0; i < OBJECTS; i++) {
+        objs[i] = malloc(i + 1);
+        if (objs[i] == NULL) {
+            fprintf(stderr, "Test 4 Failed: Unable to allocate object %d\n", i);
+            exit(1);
+        }
+    }
+
+    // Usable size must cover the request, including the slack from rounding
+    for (i = 0; i < OBJECTS; i++) {
+        size_t usable = malloc_usable_size(objs[i]);
+        if (usable < (size_t)(i + 1)) {
+            fprintf(stderr, "Test 4 Failed: Object %d has usable size %zu\n", i, usable);
+            exit(1);
+        }
+#ifndef REALMALLOC
+        // mymalloc() only rounds up to 8, so the slack is exactly that rounding
+        if (usable != (size_t)((i + 1 + 7) & ~7)) {
+            fprintf(stderr, "Test 4 Failed: Object %d has usable size %zu, expected %d\n", i, usable, (i + 1 + 7) & ~7);
+            exit(1);
+        }
+#endif
+        memset(objs[i], i, usable);
+    }
+
+    // Free half the objects with the size they were requested with, and the other half
+    // with their usable size, like a container that grew into the slack would
+    for (i = 0; i < OBJECTS; i++) {
+        if (i % 2 == 0) {
+            free_sized(objs[i], i + 1);
+        } else {
+            free_sized(objs[i], malloc_usable_size(objs[i]));
+        }
+    }
+
+    // malloc(0) hands out a chunk that is just a header, which has no usable bytes
+    char *empty = malloc(0);
+    if (empty == NULL) {
+        fprintf(stderr, "Test 4 Failed: Unable to allocate 0 bytes\n");
+        exit(1);
+    }
+#ifndef REALMALLOC
+    if (malloc_usable_size(empty) != 0) {
+        fprintf(stderr, "Test 4 Failed: malloc(0) has usable size %zu\n", malloc_usable_size(empty));
+        exit(1);
+    }
+#endif
+    free_sized(empty, 0);
+
+    // The whole heap should have coalesced back into one free chunk
+    char *large_obj = malloc(MEMSIZE - HEADERSIZE);
+    if (large_obj == NULL) {
+        fprintf(stderr, "Test 4 Failed: Heap did not coalesce after sized free\n");
+        exit(1);
+    }
+    free_sized(large_obj, MEMSIZE - HEADERSIZE);
+
+    printf("Test 4 Passed: Sized free and usable size working\n");
+}
+
 void test_free_invalid_pointer();
 void test_free_not_start_of_chunk();
 void test_double_free();
+void test_free_sized_wrong_size();
+void test_free_sized_huge_size();
+void test_free_sized_fake_header();
+void test_usable_size_fake_header();
 
 void run_test_in_child(void (*test_func)(void), const char *test_name) {
     pid_t pid = fork();
@@ -197,6 +271,18 @@ int test_error_detection() {
     printf("Running test: Double free...\n");
     run_test_in_child(test_double_free, "Test 'double free'");
 
+    printf("Running test: Sized free with wrong size...\n");
+    run_test_in_child(test_free_sized_wrong_size, "Test 'sized free wrong size'");
+
+    printf("Running test: Sized free with size near SIZE_MAX...\n");
+    run_test_in_child(test_free_sized_huge_size, "Test 'sized free huge size'");
+
+    printf("Running test: Sized free on a fake header inside a chunk...\n");
+    run_test_in_child(test_free_sized_fake_header, "Test 'sized free fake header'");
+
+    printf("Running test: Usable size of a fake header inside a chunk...\n");
+    run_test_in_child(test_usable_size_fake_header, "Test 'usable size fake header'");
+
     return 0;
 }
 
@@ -222,6 +308,39 @@ void test_double_free() {
     free(p);  // Second free, should trigger an error and exit
 }
 
+//Calling free_sized() with a size that doesn't match the allocation
+void test_free_sized_wrong_size() {
+    char *p = malloc(16);
+    printf("Attempting to free with a size that doesn't match the allocation...\n");
+    free_sized(p, 64);  // This should trigger an error and exit
+}
+
+//Calling free_sized() with a size so large that rounding it up wraps around
+void test_free_sized_huge_size() {
+    char *p = malloc(1);
+    printf("Attempting to free with a size near SIZE_MAX...\n");
+    free_sized(p, (size_t)-1);  // This should trigger an error and exit
+}
+
+//Calling free_sized() on user data that looks like a chunk header
+void test_free_sized_fake_header() {
+    char *p = malloc(64);
+    memset(p, 0, 64);
+    *(size_t *)p = 32;  // Fake size
+    *(char **)(p + 16) = (char *)8;  // Fake next pointer
+    printf("Attempting to free a fake chunk inside an allocated chunk...\n");
+    free_sized(p + HEADERSIZE, 8);  // This should trigger an error and exit
+}
+
+//Calling malloc_usable_size() on user data that looks like a chunk header
+void test_usable_size_fake_header() {
+    char *p = malloc(64);
+    memset(p, 0, 64);
+    *(size_t *)p = 1024;  // Fake size reaching past the real chunk
+    printf("Attempting to get the usable size of a fake chunk inside an allocated chunk...\n");
+    malloc_usable_size(p + HEADERSIZE);  // This should trigger an error and exit
+}
+
 int main(int argc, char **argv) {
     printf("Starting memory allocation tests...\n");
 
@@ -234,10 +353,13 @@ int main(int argc, char **argv) {
     // Test 3: Coalescing of Free Blocks
     test_coalescing();
 
-	// Test 4: Leak Detection
+    // Test 4: Sized Free and Usable Size
+    test_sized_free();
+
+	// Test 5: Leak Detection
     test_leak_detection();
 	
-    // Test 5: Error Detection
+    // Test 6: Error Detection
     test_error_detection();
 
     
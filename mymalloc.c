@@ -86,7 +86,7 @@ void *mymalloc(size_t size, char *file, int line) {
     return NULL;
 }
 
-void coalesce(chunk_header *current) {
+void merge_chunks(chunk_header *prev, chunk_header *current) {
     // Coalesce with the next chunk if it's free
     if (current->next != NULL && current->next->is_free) {
         // Merge current chunk with the next chunk
@@ -95,16 +95,20 @@ void coalesce(chunk_header *current) {
     }
 
     // Coalesce with the previous chunk if it's free
+    if (prev != NULL && prev->is_free) {
+        prev->size += current->size;
+        prev->next = current->next;
+    }
+}
+
+void coalesce(chunk_header *current) {
     chunk_header *prev = head;
     //Traverse Linked List until it's before current
     while (prev != NULL && prev->next != current) {
         prev = prev->next;
     }
 
-    if (prev != NULL && prev->is_free) {
-        prev->size += current->size;
-        prev->next = current->next;
-    }
+    merge_chunks(prev, current);
 }
 
 void myfree(void *ptr, char *file, int line) {
@@ -149,3 +153,80 @@ void myfree(void *ptr, char *file, int line) {
 }
 
 
+
+// Finds the header for ptr and checks it is a real allocated chunk. The cheap
+// checks (ptr 8-aligned inside the heap, header describing an allocated chunk
+// that fits in the heap) also pass on user data inside a live chunk, so the
+// chunk must also be head or linked from the list. That walk finds the chunk
+// before it too, which is returned in prev for coalescing. caller names the
+// function in the error message.
+chunk_header *lookup_header(void *ptr, chunk_header **prev, char *caller, char *file, int line) {
+    char *start = heap.bytes + sizeof(chunk_header);
+    char *end = heap.bytes + MEMLENGTH;
+
+    //mymalloc(0) on the last chunk can hand out a payload pointer equal to end
+    if (head == NULL || (char *)ptr < start || (char *)ptr > end || ((char *)ptr - heap.bytes) % 8 != 0) {
+        fprintf(stderr, "%s: Inappropriate pointer (%s:%d)\n", caller, file, line);
+        exit(2);
+    }
+
+    //A chunk from mymalloc(0) is just a header
+    chunk_header *chunk = (chunk_header *)((char *)ptr - sizeof(chunk_header));
+    if (chunk->is_free || chunk->size < sizeof(chunk_header) || chunk->size % 8 != 0
+            || chunk->size > (size_t)(end - (char *)chunk)) {
+        fprintf(stderr, "%s: Inappropriate pointer (%s:%d)\n", caller, file, line);
+        exit(2);
+    }
+
+    *prev = NULL;
+    if (chunk != head) {
+        *prev = head;
+        while (*prev != NULL && (*prev)->next != chunk) {
+            *prev = (*prev)->next;
+        }
+        if (*prev == NULL) {
+            fprintf(stderr, "%s: Inappropriate pointer (%s:%d)\n", caller, file, line);
+            exit(2);
+        }
+    }
+
+    return chunk;
+}
+
+void myfree_sized(void *ptr, size_t size, char *file, int line) {
+    if (ptr == NULL) {
+        return; // No action needed for NULL pointer
+    }
+
+    //Only one list walk: lookup_header() finds prev while validating the chunk
+    chunk_header *prev;
+    chunk_header *chunk = lookup_header(ptr, &prev, "free", file, line);
+
+    //Sizes larger than the heap can't match, and rounding them could wrap around
+    if (size > MEMLENGTH) {
+        fprintf(stderr, "free: Size %zu does not match allocation (%s:%d)\n", size, file, line);
+        exit(2);
+    }
+
+    //mymalloc() only skips the split when the leftover can't hold another header,
+    //so a chunk is at most one header larger than the request needed
+    size_t chunk_size = ((size + 7) & ~7) + sizeof(chunk_header);
+    if (chunk->size < chunk_size || chunk->size > chunk_size + sizeof(chunk_header)) {
+        fprintf(stderr, "free: Size %zu does not match allocation (%s:%d)\n", size, file, line);
+        exit(2);
+    }
+
+    // Mark chunk as free
+    chunk->is_free = true;
+    merge_chunks(prev, chunk);
+}
+
+size_t mymalloc_usable_size(void *ptr, char *file, int line) {
+    if (ptr == NULL) {
+        return 0;
+    }
+
+    chunk_header *prev;
+    chunk_header *chunk = lookup_header(ptr, &prev, "malloc_usable_size", file, line);
+    return chunk->size - sizeof(chunk_header); //Includes slack from rounding and unsplit chunks
+}
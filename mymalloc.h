@@ -4,8 +4,12 @@
 
 #define malloc(x) mymalloc(x, __FILE__, __LINE__)
 #define free(x) myfree(x, __FILE__, __LINE__)
+#define free_sized(x, n) myfree_sized(x, n, __FILE__, __LINE__)
+#define malloc_usable_size(x) mymalloc_usable_size(x, __FILE__, __LINE__)
 
 void *mymalloc(size_t size, char *file, int line);
 void myfree(void *ptr, char *file, int line);
+void myfree_sized(void *ptr, size_t size, char *file, int line);
+size_t mymalloc_usable_size(void *ptr, char *file, int line);
 
 #endif